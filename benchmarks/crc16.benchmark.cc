@@ -0,0 +1,101 @@
+/*
+ Copyright (C) 2026 Fredrik Öhrström (gpl-3.0-or-later)
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Benchmark for the EN13757 crc and the stripping of the dll block crcs.
+//
+//   make benchmark crc16
+//   ./build/crc16.benchmark <iterations>
+//
+// The bitwise case is the previous bit by bit implementation, kept here as a baseline.
+// 16 bytes is a frame format A block and 126 bytes is the first frame format B block.
+
+#include"benchmark.h"
+#include"crypto/crc16.h"
+#include"wmbus.h"
+
+#include<vector>
+
+using namespace std;
+
+static uint16_t crc16_EN13757_bitwise(const uchar *data, size_t len)
+{
+    uint16_t crc = 0;
+    for (size_t i = 0; i < len; ++i)
+    {
+        uchar b = data[i];
+        for (int j = 0; j < 8; ++j)
+        {
+            if (((crc & 0x8000) >> 8) ^ (b & 0x80)) crc = (crc << 1) ^ 0x3D65;
+            else crc = (crc << 1);
+            b <<= 1;
+        }
+    }
+    return ~crc;
+}
+
+int main(int argc, char **argv)
+{
+    int64_t iterations = benchmark::iterations(argc, argv, 1000LL*1000);
+
+    vector<uchar> data(126);
+    for (size_t i = 0; i < data.size(); ++i) data[i] = (uchar)(i*31+7);
+
+    benchmark::run("bitwise 16", iterations, [&](int64_t i) -> uint64_t {
+        data[0] = (uchar)i;
+        return crc16_EN13757_bitwise(&data[0], 16);
+    });
+
+    benchmark::run("crc16_EN13757 16", iterations, [&](int64_t i) -> uint64_t {
+        data[0] = (uchar)i;
+        return crc16_EN13757(&data[0], 16);
+    });
+
+    benchmark::run("bitwise 126", iterations/4, [&](int64_t i) -> uint64_t {
+        data[0] = (uchar)i;
+        return crc16_EN13757_bitwise(&data[0], 126);
+    });
+
+    benchmark::run("crc16_EN13757 126", iterations/4, [&](int64_t i) -> uint64_t {
+        data[0] = (uchar)i;
+        return crc16_EN13757(&data[0], 126);
+    });
+
+    // A frame format A telegram with 100 bytes of content, i.e. 10+16*5+10 bytes in 7 blocks.
+    vector<uchar> plain(100);
+    for (size_t i = 0; i < plain.size(); ++i) plain[i] = (uchar)(i*13+5);
+    plain[0] = plain.size()-1;
+    vector<uchar> frame;
+    size_t pos = 0;
+    while (pos < plain.size())
+    {
+        size_t n = pos == 0 ? 10 : std::min((size_t)16, plain.size()-pos);
+        frame.insert(frame.end(), plain.begin()+pos, plain.begin()+pos+n);
+        uint16_t crc = crc16_EN13757(&plain[pos], n);
+        frame.push_back(crc >> 8);
+        frame.push_back(crc & 0xff);
+        pos += n;
+    }
+
+    vector<uchar> payload;
+    benchmark::run("trimCRCsFrameFormatA", iterations/4, [&](int64_t i) -> uint64_t {
+        payload = frame;
+        trimCRCsFrameFormatA(payload);
+        return payload.size();
+    });
+
+    return 0;
+}
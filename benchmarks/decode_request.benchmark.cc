@@ -0,0 +1,52 @@
+/*
+ Copyright (C) 2026 Fredrik Öhrström (gpl-3.0-or-later)
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Parsing of a decode request line, the fast json path against the generic xmq parser.
+//
+//   make benchmark decode_request
+
+#include"benchmark.h"
+#include"decode_api.h"
+
+#include<string>
+
+using namespace std;
+
+int main(int argc, char **argv)
+{
+    int64_t n = benchmark::iterations(argc, argv, 1LL*100*1000);
+
+    string line = "{\"_\": \"decode\", \"telegram\": \"2A442D2C998734761B168D2091D37CAC21E1D68CDAFFCD3DC452BD802913FF7B1706CA9E355D6C2701CC24\", \"key\": \"28F64A24988064A079AA2C807D6102AE\"}";
+    // The seq number member makes the fast path give up.
+    string generic_line = "{\"_\": \"decode\", \"seq\": 1, \"telegram\": \"2A442D2C998734761B168D2091D37CAC21E1D68CDAFFCD3DC452BD802913FF7B1706CA9E355D6C2701CC24\", \"key\": \"28F64A24988064A079AA2C807D6102AE\"}";
+
+    benchmark::run("fast json", n, [&](int64_t) -> uint64_t {
+        DecodeRequest req;
+        string error;
+        parseDecodeRequest(line, &req, &error);
+        return req.telegram.size();
+    });
+
+    benchmark::run("xmq", n, [&](int64_t) -> uint64_t {
+        DecodeRequest req;
+        string error;
+        parseDecodeRequest(generic_line, &req, &error);
+        return req.telegram.size();
+    });
+
+    return 0;
+}
@@ -0,0 +1,100 @@
+/*
+ Copyright (C) 2026 Fredrik Öhrström (gpl-3.0-or-later)
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Benchmark for auto detection of meter drivers from the mfct,version,type triple.
+//
+//   make benchmark driver_detection
+//   ./build/driver_detection.benchmark <iterations>
+//
+// All builtin drivers are loaded, then every registered mvt is detected in turn.
+// The linear case is the previous scan over allDrivers() calling DriverInfo::detect,
+// kept here as a baseline for the hash indexed detectDriverForMVT.
+
+#include"benchmark.h"
+#include"config.h"
+#include"drivers.h"
+#include"meters.h"
+#include"wmbus.h"
+
+#include<vector>
+
+using namespace std;
+
+int main(int argc, char **argv)
+{
+    int64_t iterations = benchmark::iterations(argc, argv, 1000LL*1000);
+
+    prepareBuiltinDrivers();
+    Configuration config;
+    config.drivers_dir = "/nonexistent";
+    forceLoadAllDrivers(&config);
+
+    vector<MVT> mvts;
+    for (DriverInfo *di : allDrivers())
+    {
+        for (MVT &mvt : di->mvts())
+        {
+            if (mvt.mfct == 0 && mvt.version == 0 && mvt.type == 0) continue;
+            // Replace wildcards with a concrete value, as found in a real telegram.
+            MVT m = mvt;
+            if (m.version == 0xff) m.version = 0x01;
+            if (m.type == 0xff) m.type = 0x07;
+            mvts.push_back(m);
+        }
+    }
+    // Add some mvts that do not belong to any driver.
+    mvts.push_back({ 0x1234, 0x99, 0x99 });
+    mvts.push_back({ 0x4321, 0x42, 0x03 });
+
+    printf("%zu drivers %zu mvts\n", allDrivers().size(), mvts.size());
+
+    const size_t count = mvts.size();
+
+    benchmark::run("linear", iterations, [&](int64_t i) -> uint64_t {
+        MVT &m = mvts[i % count];
+        for (DriverInfo *di : allDrivers())
+        {
+            if (di->detect(m.mfct, m.version, m.type)) return (uint64_t)(size_t)di;
+        }
+        return 0;
+    });
+
+    benchmark::run("detectDriverForMVT", iterations, [&](int64_t i) -> uint64_t {
+        MVT &m = mvts[i % count];
+        return (uint64_t)(size_t)detectDriverForMVT(m.mfct, m.version, m.type);
+    });
+
+    // Includes copying the returned DriverInfo.
+    Telegram t;
+    benchmark::run("pickMeterDriver", iterations, [&](int64_t i) -> uint64_t {
+        MVT &m = mvts[i % count];
+        t.dll_mfct = m.mfct;
+        t.dll_version = m.version;
+        t.dll_type = m.type;
+        DriverInfo di = pickMeterDriver(&t);
+        return (uint64_t)di.mvts().size();
+    });
+
+    benchmark::run("detectMeterDrivers", iterations, [&](int64_t i) -> uint64_t {
+        MVT &m = mvts[i % count];
+        vector<string> drivers;
+        detectMeterDrivers(m.mfct, m.version, m.type, &drivers);
+        return (uint64_t)drivers.size();
+    });
+
+    return 0;
+}
@@ -0,0 +1,78 @@
+/*
+ Copyright (C) 2026 Fredrik Öhrström (gpl-3.0-or-later)
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Benchmark for creating many meters of the same dynamic driver.
+//
+//   make benchmark meter_create
+//   ./build/meter_create.benchmark <iterations>
+//
+// Every iteration creates one more meter and keeps it, the growth of the
+// resident set is printed after each case.
+
+#include"benchmark.h"
+#include"config.h"
+#include"drivers.h"
+#include"meters.h"
+
+#include<stdio.h>
+#include<unistd.h>
+#include<vector>
+
+using namespace std;
+
+static size_t residentBytes()
+{
+    size_t pages = 0, resident = 0;
+    FILE *f = fopen("/proc/self/statm", "r");
+    if (!f) return 0;
+    if (fscanf(f, "%zu %zu", &pages, &resident) != 2) resident = 0;
+    fclose(f);
+    return resident * sysconf(_SC_PAGESIZE);
+}
+
+static void createMeters(const char *name, const char *driver, int64_t iterations)
+{
+    vector<shared_ptr<Meter>> meters;
+    meters.reserve(iterations);
+
+    size_t before = residentBytes();
+    benchmark::run(name, iterations, [&](int64_t i) -> uint64_t {
+        MeterInfo mi;
+        mi.parse("Meter"+to_string(i), driver, tostrprintf("%08d", (int)i), "");
+        meters.push_back(createMeter(&mi));
+        return meters.size();
+    });
+    size_t after = residentBytes();
+
+    printf("%-22s %14.1f MiB   %8.0f bytes/meter\n", name,
+           (after-before)/(1024.0*1024.0), (double)(after-before)/iterations);
+}
+
+int main(int argc, char **argv)
+{
+    int64_t iterations = benchmark::iterations(argc, argv, 10LL*1000);
+
+    prepareBuiltinDrivers();
+    Configuration config;
+    config.drivers_dir = "/nonexistent";
+    forceLoadAllDrivers(&config);
+
+    createMeters("multical21", "multical21", iterations);
+    createMeters("abbb23", "abbb23", iterations);
+
+    return 0;
+}
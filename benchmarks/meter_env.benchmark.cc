@@ -0,0 +1,73 @@
+/*
+ Copyright (C) 2026 Fredrik Öhrström (gpl-3.0-or-later)
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Benchmark for building the METER_ shell env variables of a printed telegram.
+//
+//   make benchmark meter_env
+//   ./build/meter_env.benchmark <iterations>
+//
+// The fresh case passes a new envs vector for every telegram, the reused case
+// passes the same vector every time, as the printer does.
+
+#include"benchmark.h"
+#include"config.h"
+#include"drivers.h"
+#include"meters.h"
+#include"wmbus.h"
+
+#include<vector>
+
+using namespace std;
+
+int main(int argc, char **argv)
+{
+    int64_t iterations = benchmark::iterations(argc, argv, 100LL*1000);
+
+    prepareBuiltinDrivers();
+    Configuration config;
+    config.drivers_dir = "/nonexistent";
+    forceLoadAllDrivers(&config);
+
+    MeterInfo mi;
+    mi.parse("Tempoo", "lansenth", "00010203", "");
+    shared_ptr<Meter> meter = createMeter(&mi);
+
+    vector<uchar> frame;
+    hex2bin("2e44333003020100071b7a634820252f2f0265840842658308820165950802fb1aae0142fb1aae018201fb1aa9012f", &frame);
+    AboutTelegram about("", 0, LinkMode::T1, FrameType::WMBUS);
+    vector<Address> addresses;
+    bool id_match = false;
+    Telegram t;
+    meter->handleTelegram(about, frame, true, &addresses, &id_match, &t);
+
+    vector<string> more_json, selected_fields;
+    string hr, fields, json;
+
+    benchmark::run("fresh envs", iterations, [&](int64_t i) -> uint64_t {
+        vector<string> envs;
+        meter->printMeter(&t, &hr, &fields, '\t', &json, &envs, &more_json, &selected_fields, false);
+        return envs.size();
+    });
+
+    vector<string> envs;
+    benchmark::run("reused envs", iterations, [&](int64_t i) -> uint64_t {
+        meter->printMeter(&t, &hr, &fields, '\t', &json, &envs, &more_json, &selected_fields, false);
+        return envs.size();
+    });
+
+    return 0;
+}
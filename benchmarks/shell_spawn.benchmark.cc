@@ -0,0 +1,64 @@
+/*
+ Copyright (C) 2026 Fredrik Öhrström (gpl-3.0-or-later)
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Benchmark for starting a shell from a daemon with a large resident set.
+//
+//   make benchmark shell_spawn
+//   ./build/shell_spawn.benchmark <iterations>
+//
+// 512 MiB are allocated and touched first. The fork case is the previous
+// fork+execvpe+waitpid, kept here as a baseline for the posix_spawn based invokeShell.
+
+#include"benchmark.h"
+#include"shell.h"
+
+#include<sys/wait.h>
+#include<unistd.h>
+#include<vector>
+
+using namespace std;
+
+extern char **environ;
+
+int main(int argc, char **argv)
+{
+    int64_t iterations = benchmark::iterations(argc, argv, 200);
+
+    vector<char> rss(512*1024*1024);
+    for (size_t i = 0; i < rss.size(); i += 4096) rss[i] = (char)i;
+
+    benchmark::run("fork", iterations, [&](int64_t i) -> uint64_t {
+        const char *args[] = { "/bin/true", NULL };
+        pid_t pid = fork();
+        if (pid == 0)
+        {
+            execve(args[0], (char*const*)args, environ);
+            _exit(127);
+        }
+        int status;
+        waitpid(pid, &status, 0);
+        return status;
+    });
+
+    benchmark::run("invokeShell", iterations, [&](int64_t i) -> uint64_t {
+        invokeShell("/bin/true", {}, {});
+        return 0;
+    });
+
+    benchmark::keep(rss[4096]);
+    return 0;
+}
@@ -118,9 +118,9 @@ CORE_SRCS="
   $SRC/crypto/crc16.cc  $SRC/crypto/aes.cc  $SRC/crypto/aescmac.cc  $SRC/crypto/sha256.cc $SRC/crypto/des.cc
   $SRC/dvparser.cc  $SRC/wmbus.cc  $SRC/wmbus_utils.cc  $SRC/wmbus_simulator.cc
   $SRC/address.cc  $SRC/units.cc  $SRC/translatebits.cc  $SRC/formula.cc
-  $SRC/meters.cc  $SRC/metermanager.cc  $SRC/printer.cc  $SRC/drivers.cc
+  $SRC/meters.cc  $SRC/metermanager.cc  $SRC/poll_scheduler.cc  $SRC/printer.cc  $SRC/drivers.cc
   $SRC/manufacturer_specificities.cc  $SRC/log.cc $SRC/util.cc  $SRC/config.cc  $SRC/cmdline.cc
-  $SRC/utils/fs.cc $SRC/utils/signal_handling.cc $SRC/utils/slip.cc
+  $SRC/utils/fs.cc $SRC/utils/hex.cc $SRC/utils/signal_handling.cc $SRC/utils/slip.cc
   $SRC/wmbus/link_mode.cc
   $SRC/wmbus_amb8465.cc  $SRC/wmbus_im871a.cc  $SRC/wmbus_iu891a.cc
   $SRC/wmbus_cul.cc  $SRC/wmbus_rc1180.cc  $SRC/wmbus_rawtty.cc
@@ -208,6 +208,7 @@ shared_ptr<SerialDevice> SerialCommunicationManagerImp::createSerialDeviceComman
 shared_ptr<SerialDevice> SerialCommunicationManagerImp::createSerialDeviceFile(string, string) { return nullptr; }
 shared_ptr<SerialDevice> SerialCommunicationManagerImp::createSerialDeviceSimulator() { return nullptr; }
 shared_ptr<SerialDevice> SerialCommunicationManagerImp::createSerialDeviceSocket(string, string) { return nullptr; }
+shared_ptr<SerialDevice> SerialCommunicationManagerImp::createSerialDeviceRtlSdr(string, int, uint32_t, uint32_t, int, string) { return nullptr; }
 
 void SerialCommunicationManagerImp::listenTo(SerialDevice* sd, function<void()> cb) {
     if (sd && cb) {
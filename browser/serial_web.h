@@ -111,6 +111,8 @@ struct SerialCommunicationManagerImp : public SerialCommunicationManager
     shared_ptr<SerialDevice> createSerialDeviceFile(string file, string purpose) override;
     shared_ptr<SerialDevice> createSerialDeviceSimulator() override;
     shared_ptr<SerialDevice> createSerialDeviceSocket(string path, string purpose) override;
+    shared_ptr<SerialDevice> createSerialDeviceRtlSdr(string identifier, int index, uint32_t freq,
+                                                      uint32_t sample_rate, int ppm, string purpose) override;
 
     void listenTo(SerialDevice* sd, function<void()> cb) override;
     void onDisappear(SerialDevice* sd, function<void()> cb) override;
@@ -237,6 +237,7 @@ shared_ptr<BusDevice> openXmqTTY(Detected, shared_ptr<SerialCommunicationManager
 shared_ptr<BusDevice> openIU880B(Detected, shared_ptr<SerialCommunicationManager>, shared_ptr<SerialDevice>) { return nullptr; }
 shared_ptr<BusDevice> openSocket(Detected, shared_ptr<SerialCommunicationManager>, shared_ptr<SerialDevice>) { return nullptr; }
 shared_ptr<BusDevice> openRTLWMBUS(Detected, string, bool, shared_ptr<SerialCommunicationManager>, shared_ptr<SerialDevice>) { return nullptr; }
+shared_ptr<BusDevice> openIQWMBUS(Detected, shared_ptr<SerialCommunicationManager>, shared_ptr<SerialDevice>) { return nullptr; }
 shared_ptr<BusDevice> openRTL433(Detected, string, bool, shared_ptr<SerialCommunicationManager>, shared_ptr<SerialDevice>) { return nullptr; }
 
 AccessCheck detectMBUS(Detected*, shared_ptr<SerialCommunicationManager>) { return AccessCheck::NoSuchDevice; }
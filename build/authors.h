@@ -0,0 +1,45 @@
+/*
+ Copyright (C) 2017-2026 Fredrik Öhrström (gpl-3.0-or-later)
+
+ This program is free software: you can redistribute it and/or modify
+ it under the terms of the GNU General Public License as published by
+ the Free Software Foundation, either version 3 of the License, or
+ (at your option) any later version.
+
+ This program is distributed in the hope that it will be useful,
+ but WITHOUT ANY WARRANTY; without even the implied warranty of
+ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ GNU General Public License for more details.
+
+ You should have received a copy of the GNU General Public License
+ along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef AUTHORS_H
+#define AUTHORS_H
+
+inline constexpr const char* AUTHORS = R"AUTHORS(
+Copyright (C) 2017-2026 Fredrik Öhrström
+                   2026 Hynek Moravec
+                   2026 Felix Hauptmann
+                   2026 Aras Abbasi
+                   2025 obidobi
+                   2025 Karel Blavka
+                   2024 Marton Czwick
+                   2024 Arthur van Dorp
+                   2023 Andreas Horrer
+                   2022 thecem
+                   2022 Patrick Schwarz
+                   2022 Alexander Streit
+                   2021 Vincent Privat
+                   2021 Olli Salonen
+                   2020 Janus Bo Andersen
+                   2020 Eric Bus
+                   2020 Avandorp
+                   2019 kokke
+                   2019 Jacek Tomasiak
+                   2018 David Mallon
+                   2013 WaterJuice
+                   2013 Tom St Denis
+)AUTHORS";
+#endif